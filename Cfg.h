@@ -0,0 +1,82 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * Cfg.h - Definition of a class to split the functions of a module
+ * into basic blocks.
+ ***************************************************************/
+
+#ifndef __CFG_H__
+#define __CFG_H__
+
+#include <stdio.h>
+#include <vector>
+#include "types.h"
+#include "disasm.h"
+
+class CProcessPrx;
+
+/* Basic block flags */
+#define CFG_BLOCK_RETURN   0x01 /* Ends in a return */
+#define CFG_BLOCK_INDIRECT 0x02 /* Ends in a computed jump */
+#define CFG_BLOCK_CALLS    0x04 /* Contains a call */
+#define CFG_BLOCK_EXIT     0x08 /* Ends in a branch out of the function, a tail call */
+
+struct CfgBlock
+{
+	u32 start;
+	/** Address after the last instruction */
+	u32 end;
+	/** Index into the successor array */
+	u32 firstSucc;
+	u16 iSuccs;
+	u16 flags;
+	u32 iInsns;
+};
+
+struct CfgFunc
+{
+	u32 addr;
+	/** End of the code reachable from the start, bytes after it are not part of the function */
+	u32 end;
+	/** Index of the entry block, the blocks of a function are contiguous and sorted by address */
+	u32 firstBlock;
+	u32 iBlocks;
+};
+
+/** Class to build the control flow graphs of the functions of a module.
+ *  Each function is decoded once from its start, following local branches
+ *  up to the next function, and the blocks are stored in flat arrays.
+ */
+class CCfg
+{
+	std::vector<CfgFunc> m_funcs;
+	std::vector<CfgBlock> m_blocks;
+	/** Successors of each block as block indexes */
+	std::vector<u32> m_succs;
+	/** Per instruction slot state of the function being built */
+	std::vector<u8> m_slots;
+	std::vector<u32> m_targets;
+	std::vector<u32> m_blockOf;
+	std::vector<u32> m_work;
+
+	void BuildFunc(const u8 *pData, u32 dwAddr, u32 iSize);
+public:
+	CCfg();
+	~CCfg();
+	/** Build the graphs of every function symbol of a loaded module, uses the disassembler.
+	 *  With dwEnd above dwStart only the functions starting in that range are built.
+	 */
+	void Build(CProcessPrx &prx, u32 dwStart = 0, u32 dwEnd = 0);
+	void Clear();
+	int GetFuncCount() const;
+	const CfgFunc &GetFunc(int iFunc) const;
+	/** Index of the function starting at an address, -1 if none */
+	int FindFunc(u32 dwAddr) const;
+	const CfgBlock &GetBlock(u32 iBlock) const;
+	const u32 *GetSuccs(const CfgBlock &block) const;
+	/** Write the functions and their blocks as JSON, named from the symbols */
+	void WriteJson(FILE *fp, const char *szFilename, const SymbolMap &syms) const;
+};
+
+#endif
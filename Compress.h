@@ -0,0 +1,32 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * Compress.h - Compressed output streams, using zstd or zlib
+ * depending on what configure found.
+ ***************************************************************/
+#ifndef __COMPRESS_H__
+#define __COMPRESS_H__
+
+#include <stdio.h>
+#include "types.h"
+
+/* Uncompressed bytes handed to the compression thread at a time */
+#define COMPRESS_BLOCK (1024 * 1024)
+
+/** Extension of compressed files, ".zst" or ".gz". NULL if prxtool was
+ *  built without compression.
+ */
+const char *compressExtension();
+
+/** Whether the name of an output file asks for it to be compressed */
+bool compressWanted(const char *szFile);
+
+/** Wrap a stream so everything written to it is compressed on a thread of
+ *  its own. Closing the returned stream finishes the compressed data and
+ *  closes fp, except for stdout which is flushed. Returns fp unchanged if
+ *  compression is not available.
+ */
+FILE *compressOpen(FILE *fp);
+
+#endif
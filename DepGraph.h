@@ -0,0 +1,95 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * DepGraph.h - Definition of a class to resolve the imports of a
+ * set of modules against their exports.
+ ***************************************************************/
+
+#ifndef __DEPGRAPH_H__
+#define __DEPGRAPH_H__
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "types.h"
+
+class CProcessPrx;
+
+/** A module added to the graph */
+struct DepModule
+{
+	/** File the module was loaded from */
+	std::string file;
+	/** Module name from the module info */
+	std::string name;
+	/** Number of exported functions and variables */
+	u32 exports;
+	/** Number of imported functions and variables */
+	u32 imports;
+	/** Number of imports with no matching export */
+	u32 unresolved;
+};
+
+/** A single exported function or variable */
+struct DepExport
+{
+	/** Interned library name */
+	u32 lib;
+	u32 nid;
+	/** Index of the exporting module */
+	u32 module;
+	u32 addr;
+};
+
+/** A single imported function or variable */
+struct DepImport
+{
+	/** Interned library name */
+	u32 lib;
+	u32 nid;
+	/** Index of the importing module */
+	u32 module;
+	/** Address of the import stub */
+	u32 addr;
+	/** Index into the export list, -1 if unresolved */
+	s32 target;
+	bool var;
+	std::string name;
+};
+
+enum DepGraphFormat
+{
+	DEPGRAPH_DOT = 0,
+	DEPGRAPH_JSON = 1
+};
+
+/** Class to build a module dependency graph from real exports */
+class CDepGraph
+{
+	std::vector<DepModule> m_modules;
+	std::vector<DepExport> m_exports;
+	std::vector<DepImport> m_imports;
+	/** Interned library names */
+	std::vector<std::string> m_libs;
+	std::map<std::string, u32> m_libIds;
+	/** Open addressed (library, nid) table of indexes into m_exports, -1 is empty */
+	std::vector<s32> m_table;
+	/** Number of exports which duplicated an earlier (library, nid) */
+	u32 m_iDuplicates;
+
+	u32 InternLib(const char *szName);
+	void BuildTable();
+	s32 FindExport(u32 lib, u32 nid);
+	void WriteDot(FILE *fp);
+	void WriteJson(FILE *fp);
+public:
+	CDepGraph();
+	~CDepGraph();
+	void AddModule(const char *szFilename, CProcessPrx &prx);
+	void Resolve();
+	void Write(FILE *fp, DepGraphFormat format);
+};
+
+#endif
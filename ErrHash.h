@@ -0,0 +1,50 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * ErrHash.h - Definitions for the perfect hash of error code names
+ ***************************************************************/
+#ifndef __ERRHASH_H__
+#define __ERRHASH_H__
+
+#include <stdlib.h>
+#include "types.h"
+
+/** A slot of the hash, code is 0 for an empty slot */
+struct ErrHashEntry
+{
+	u32 code;
+	const char *name;
+};
+
+/** Hash and displace table written by mkerrhash. A code's bucket picks a
+ *  displacement which moves it to a slot no other code uses.
+ */
+struct ErrHashTable
+{
+	/** Displacement of each of the 1 << iBucketBits buckets */
+	const u16 *disp;
+	u32 iBucketBits;
+	/** The 1 << iSlotBits slots */
+	const ErrHashEntry *slots;
+	u32 iSlotBits;
+};
+
+/* Both sides of the hash, shared by mkerrhash and the lookup. Bits is never 0 */
+static inline u32 errHashBucket(u32 code, u32 iBits)
+{
+	return (u32) (code * 0x9E3779B1U) >> (32 - iBits);
+}
+
+static inline u32 errHashSlot(u32 code, u32 disp, u32 iBits)
+{
+	return ((u32) (code * 0x85EBCA6BU) >> (32 - iBits)) ^ disp;
+}
+
+/* Generated into ErrTable.C at build time */
+extern const ErrHashTable g_errHash;
+
+/** Name of an error code, NULL if the value is not a known error */
+const char *errLookup(u32 code);
+
+#endif
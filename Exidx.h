@@ -0,0 +1,45 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * Exidx.h - Definition of a class to read function starts from
+ * an ARM exception index table.
+ ***************************************************************/
+#ifndef __EXIDX_H__
+#define __EXIDX_H__
+
+#include <vector>
+#include "types.h"
+
+/* Second word of an entry for a function with no unwind information */
+#define EXIDX_CANTUNWIND 1
+/* Fewest entries a scanned run needs to be taken as a table */
+#define EXIDX_MIN_SCAN   4
+
+/** Class to decode the PREL31 entries of a .ARM.exidx table into the
+ *  sorted start addresses of the functions they cover.
+ */
+class CExidxTable
+{
+	std::vector<u32> m_starts;
+	/** Address range the entries must point into, end exclusive */
+	u32 m_dwTextStart;
+	u32 m_dwTextEnd;
+
+	bool IsEntry(const u8 *pData, u32 dwAddr, u32 iOfs, u32 iSize, u32 &dwTarget) const;
+public:
+	CExidxTable();
+	~CExidxTable();
+	/** Set the range of the code the entries describe */
+	void SetText(u32 dwStart, u32 dwEnd);
+	/** Decode a table at dwAddr, false if it is not a valid sorted table */
+	bool Decode(const u8 *pData, u32 dwAddr, u32 iSize);
+	/** Search memory for the longest run of entries which looks like a table,
+	 *  iOffset and iLength are the byte range found in pData.
+	 */
+	bool Scan(const u8 *pData, u32 dwAddr, u32 iSize, u32 &iOffset, u32 &iLength) const;
+	/** Sorted unique function starts, bit 0 set for Thumb functions */
+	const std::vector<u32> &GetStarts() const;
+};
+
+#endif
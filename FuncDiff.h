@@ -0,0 +1,116 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * FuncDiff.h - Definition of classes to fingerprint the functions
+ * of a module and match them against another version of it.
+ ***************************************************************/
+
+#ifndef __FUNCDIFF_H__
+#define __FUNCDIFF_H__
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "types.h"
+
+class CProcessPrx;
+
+/** A function of a module */
+struct FuncPrint
+{
+	u32 addr;
+	u32 size;
+	bool thumb;
+	/** Import stub, matched by name only */
+	bool imported;
+	/** The name came from the module rather than being made up from the address */
+	bool named;
+	std::string name;
+	/** Hash of the instructions with addresses and immediates masked */
+	u64 exact;
+	/** Hash of the instruction classes alone, survives register and constant changes */
+	u64 loose;
+	u32 iInsns;
+	/** Indexes of the functions called, in call order */
+	std::vector<s32> callees;
+	/** Indexes of the calling functions */
+	std::vector<s32> callers;
+};
+
+/** Class to split a module into functions and fingerprint each of them */
+class CFuncPrints
+{
+	std::string m_file;
+	std::vector<FuncPrint> m_funcs;
+	/** Start address of each function, sorted, to resolve call targets */
+	std::vector<u32> m_starts;
+	/** Sorted addresses of relocated words and found immediates, masked out of the hashes */
+	std::vector<u32> m_masked;
+	/** Copy of the executable sections, the workers must not touch the loader */
+	std::vector<u8> m_image;
+	u32 m_dwImageBase;
+
+	s32 FindFunc(u32 dwAddr) const;
+	void PrintArm(FuncPrint &func, std::vector<s32> &calls) const;
+	void PrintThumb(FuncPrint &func, std::vector<s32> &calls) const;
+	static void Work(void *pArg, int iThread);
+public:
+	CFuncPrints();
+	~CFuncPrints();
+	/** Fingerprint the functions of a loaded module over iThreads threads */
+	bool Build(const char *szFilename, CProcessPrx &prx, int iThreads);
+	const std::string &GetFile() const;
+	int GetCount() const;
+	const FuncPrint &GetFunc(int iFunc) const;
+};
+
+enum FuncDiffFormat
+{
+	FUNCDIFF_IDC = 0,
+	FUNCDIFF_JSON = 1
+};
+
+/** How a pair of functions was matched */
+enum FuncMatchType
+{
+	FUNCMATCH_NAME = 0,
+	FUNCMATCH_EXACT = 1,
+	FUNCMATCH_CALLS = 2,
+	FUNCMATCH_LOOSE = 3
+};
+
+struct FuncMatch
+{
+	s32 old;
+	s32 cur;
+	FuncMatchType type;
+};
+
+/** Class to match the functions of two versions of a module */
+class CFuncDiff
+{
+	const CFuncPrints &m_old;
+	const CFuncPrints &m_new;
+	std::vector<s32> m_oldToNew;
+	std::vector<s32> m_newToOld;
+	std::vector<FuncMatch> m_matches;
+
+	void AddMatch(s32 old, s32 cur, FuncMatchType type);
+	void MatchNames();
+	void MatchUnique(bool blLoose, u32 iMinInsns, FuncMatchType type);
+	void MatchGroup(const std::vector<s32> &olds, const std::vector<s32> &curs);
+	void Refine(size_t iFirst);
+public:
+	CFuncDiff(const CFuncPrints &old, const CFuncPrints &cur);
+	~CFuncDiff();
+	/** Match by name, then unique fingerprints, then along the call graph */
+	void Match();
+	int GetMatchCount() const;
+	/** Write the names of the old functions for their new addresses */
+	void WriteIdc(FILE *fp) const;
+	/** Write every match as a JSON object */
+	void WriteJson(FILE *fp) const;
+};
+
+#endif
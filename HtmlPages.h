@@ -0,0 +1,68 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * HtmlPages.h - Definition of a class to split the HTML disassembly
+ * of a module into pages with a search index.
+ ***************************************************************/
+#ifndef __HTMLPAGES_H__
+#define __HTMLPAGES_H__
+
+#include <stdio.h>
+#include <vector>
+#include "types.h"
+#include "disasm.h"
+
+class CProcessPrx;
+
+/* Default amount of code or data on a page */
+#define HTML_PAGE_SIZE   (32 * 1024)
+
+/* Script defining g_idx for the search page, browsers only let a file://
+ * page pull in files next to it through script tags
+ */
+#define HTML_INDEX_NAME "index.js"
+
+/* Page flags */
+#define HTML_PAGE_CODE 1 /* Disassembly, anchors are on every instruction rather than every 16 bytes */
+
+struct HtmlPage
+{
+	u32 start;
+	/** Address after the page */
+	u32 end;
+	/** Section index in the module */
+	u32 iSect;
+	u32 flags;
+};
+
+/** Class to split the allocated sections of a module into pages of about
+ *  the same size, breaking the code at function starts where it can. Each
+ *  page can be written on its own so they can be generated in parallel.
+ */
+class CHtmlPages
+{
+	/** Sorted by start, the pages never overlap */
+	std::vector<HtmlPage> m_pages;
+
+	void AddSection(CProcessPrx &prx, u32 iSect, u32 dwStart, u32 dwEnd, bool blCode, u32 iPageSize,
+			const std::vector<u32> &funcs);
+public:
+	/** Split the sections of a loaded module, iPageSize is in bytes of the module */
+	void Build(CProcessPrx &prx, u32 iPageSize);
+	void Clear();
+	size_t GetCount() const;
+	const HtmlPage &Get(size_t i) const;
+	/** Page holding an address, -1 if it is on none */
+	int Find(u32 dwAddr) const;
+	/** File name of a page, relative to the output directory */
+	static void GetName(int iPage, char *szName, size_t iLen);
+	/** Close a file written for the pages, false if any of it failed to be written */
+	static bool Close(FILE *fp, const char *szPath);
+	/** Write the index of pages and symbols for the search page */
+	bool WriteIndex(const char *szDir, const SymbolMap &syms) const;
+	/** Write index.html with the list of pages, and the search script */
+	bool WriteSearch(const char *szDir, const char *szTitle) const;
+};
+
+#endif
@@ -0,0 +1,49 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * IntervalSet.h - Definition of a class to hold a set of address
+ * ranges.
+ ***************************************************************/
+#ifndef __INTERVALSET_H__
+#define __INTERVALSET_H__
+
+#include <vector>
+#include "types.h"
+
+/** An address range, end exclusive */
+struct Interval
+{
+	u32 start;
+	u32 end;
+};
+
+/** Class to collect address ranges and look addresses up in them. Ranges
+ *  are added in any order, Normalize sorts and merges them and must be
+ *  called before anything is looked up.
+ */
+class CIntervalSet
+{
+	std::vector<Interval> m_ivals;
+
+	/** First range which ends after an address */
+	std::vector<Interval>::const_iterator Lower(u32 dwAddr) const;
+public:
+	CIntervalSet();
+	~CIntervalSet();
+	void Clear();
+	void Add(u32 dwStart, u32 iSize);
+	/** Sort the ranges and merge those which overlap or touch */
+	void Normalize();
+	/** End of the range holding an address, 0 if there is none */
+	u32 Find(u32 dwAddr) const;
+	bool Contains(u32 dwAddr) const;
+	/** Whether any byte of a range is in the set */
+	bool Overlaps(u32 dwAddr, u32 iSize) const;
+	u32 GetCount() const;
+	const Interval &Get(u32 i) const;
+	/** Number of bytes covered */
+	u32 GetSize() const;
+};
+
+#endif
@@ -0,0 +1,49 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * Manifest.h - Definition of a class to track batch outputs
+ * against the inputs which produced them.
+ ***************************************************************/
+
+#ifndef __MANIFEST_H__
+#define __MANIFEST_H__
+
+#include "types.h"
+#include <map>
+#include <string>
+
+/** Structure to hold a single manifest record */
+struct ManifestEntry
+{
+	/** Path of the input relative to the input directory */
+	std::string input;
+	/** Path of the output relative to the output directory */
+	std::string output;
+	/** Size of the input file */
+	u32 size;
+	/** Content hash of the input file */
+	u64 hash;
+	/** Hash of the options used to generate the output */
+	u64 opts;
+	/** Hash of the NID databases used to generate the output */
+	u64 db;
+};
+
+/** Class to load, query and save a batch manifest */
+class CManifest
+{
+	typedef std::map<std::string, ManifestEntry> ManifestMap;
+
+	ManifestMap m_entries;
+public:
+	CManifest();
+	~CManifest();
+	bool Load(const char *szFilename);
+	bool Save(const char *szFilename);
+	const ManifestEntry *Find(const char *szInput);
+	void Update(const ManifestEntry &entry);
+	void Clear();
+};
+
+#endif
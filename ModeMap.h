@@ -0,0 +1,104 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * ModeMap.h - Definition of a class to find the instruction set
+ * of the code in a module.
+ ***************************************************************/
+#ifndef __MODEMAP_H__
+#define __MODEMAP_H__
+
+#include <utility>
+#include <vector>
+#include "types.h"
+#include "IntervalSet.h"
+
+class CProcessPrx;
+
+enum InsnMode
+{
+	MODE_UNKNOWN = 0,
+	MODE_ARM = 1,
+	MODE_THUMB = 2
+};
+
+#define MODE_MASK  0x03
+#define MODE_START 0x04
+
+/** A direct branch found while following the code */
+struct ModeBranch
+{
+	u32 site;
+	u32 target;
+	/** BL or BLX rather than B */
+	bool call;
+};
+
+/** A run of code in one instruction set, for saving the map */
+struct ModeRun
+{
+	u32 addr;
+	u32 size;
+	InsnMode mode;
+};
+
+/** Class to follow the code of a module from its known entry points,
+ *  carrying the instruction set through calls and BLX, and record the
+ *  mode of every halfword reached. Anything not reached is data or dead.
+ */
+class CModeMap
+{
+	/** Address of the first halfword, including the base */
+	u32 m_dwStart;
+	/** Mode of each halfword from m_dwStart, MODE_START marks the first halfword of an instruction */
+	std::vector<u8> m_modes;
+	std::vector<ModeBranch> m_branches;
+	/** Executable ranges, end exclusive */
+	std::vector<std::pair<u32, u32> > m_ranges;
+	/** Addresses and modes still to be followed */
+	std::vector<std::pair<u32, InsnMode> > m_work;
+	u32 m_iMarked;
+	/** Known data in the code, never followed */
+	const CIntervalSet *m_pData;
+	/** Literal pools the code loads from */
+	CIntervalSet m_literals;
+
+	bool InText(u32 dwAddr, u32 iSize) const;
+	void Follow(CProcessPrx &prx, u32 dwAddr, InsnMode mode);
+public:
+	CModeMap();
+	~CModeMap();
+	/** Set up an empty map over the executable sections of a loaded module */
+	void Init(CProcessPrx &prx);
+	void Clear();
+	/** Only follow the code between dwStart and dwEnd, after Init */
+	void Clip(u32 dwStart, u32 dwEnd);
+	/** Set the ranges which are known to be data, Follow stops on them */
+	void SetData(const CIntervalSet *pData);
+	/** Queue an entry point, seeds are followed in the order given by Walk */
+	void AddSeed(u32 dwAddr, InsnMode mode);
+	/** Follow every queued seed, code already reached keeps its mode. Uses the disassembler */
+	void Walk(CProcessPrx &prx);
+	/** Mode of the code at an address, MODE_UNKNOWN if it was not reached */
+	InsnMode GetMode(u32 dwAddr) const;
+	/** Length of the instruction at a reached address, 0 if there is none */
+	u32 GetInsnSize(u32 dwAddr) const;
+	/** Branches found by Walk, sorted by site */
+	const std::vector<ModeBranch> &GetBranches();
+	/** Literal pools in the code loaded by the code Walk reached */
+	const CIntervalSet &GetLiterals() const;
+	/** Nothing was reached, the map can't tell code from data */
+	bool IsEmpty() const;
+	/** Number of halfwords reached */
+	u32 GetMarked() const;
+	void GetRuns(std::vector<ModeRun> &runs) const;
+	void SetRun(const ModeRun &run);
+	/** Bit per halfword from the start of the map, set where an instruction
+	 *  starts. The runs only keep the mode, these keep GetInsnSize working.
+	 */
+	void GetStarts(std::vector<u32> &bits) const;
+	/** Mark the starts after the runs are set, halfwords with no mode are skipped */
+	void SetStarts(const std::vector<u32> &bits);
+};
+
+#endif
@@ -0,0 +1,70 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * NidCrack.h - Definition of a class to recover the names of
+ * unresolved NIDs by brute force.
+ ***************************************************************/
+
+#ifndef __NIDCRACK_H__
+#define __NIDCRACK_H__
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "types.h"
+
+class CProcessPrx;
+
+/** A NID with no known name */
+struct CrackTarget
+{
+	/** Library the NID was imported from or exported by */
+	std::string lib;
+	u32 nid;
+	bool var;
+	/** Names found which hash to the NID, the first is used */
+	std::vector<std::string> found;
+};
+
+/** A candidate matching one of the target NIDs */
+struct CrackHit
+{
+	u32 nid;
+	std::string name;
+};
+
+/** Class to run a prefix, word (pair) and suffix search over SHA-1 NIDs */
+class CNidCracker
+{
+	std::vector<CrackTarget> m_targets;
+	/** Open addressed table of indexes into m_targets, -1 is empty */
+	std::vector<s32> m_table;
+	/** One bit per NID hash bucket, cheap rejection before the table lookup */
+	std::vector<u32> m_filter;
+	u32 m_iFilterMask;
+	std::vector<std::string> m_prefixes;
+	std::vector<std::string> m_words;
+	std::vector<std::string> m_suffixes;
+	bool m_blCombine;
+	int m_iThreads;
+
+	bool LoadList(const char *szFilename, std::vector<std::string> &list);
+	void BuildTable();
+	s32 FindTarget(u32 nid);
+	void AddHit(const CrackHit &hit);
+	static void Work(void *pArg, int iThread);
+public:
+	CNidCracker();
+	~CNidCracker();
+	int AddTargets(CProcessPrx &prx);
+	bool LoadWords(const char *szFilename);
+	bool LoadPrefixes(const char *szFilename);
+	bool LoadSuffixes(const char *szFilename);
+	void SetCombine(bool blCombine);
+	void SetThreads(int iThreads);
+	int Run();
+	void WriteJson(FILE *fp);
+};
+
+#endif
@@ -10,16 +10,14 @@
 #define __NIDMGR_H__
 
 #include "types.h"
+#include "StrPool.h"
+#include <stdio.h>
 #include <tinyxml/tinyxml.h>
 #include <vector>
 
 #define LIB_NAME_MAX 64
 #define LIB_SYMBOL_NAME_MAX 128
 
-#define FUNCTION_NAME_MAX   128
-#define FUNCTION_ARGS_MAX   128
-#define FUNCTION_RET_MAX    64
-
 struct LibraryEntry;
 
 /** Structure to hold a single library nid */
@@ -33,12 +31,12 @@ struct LibraryNid
 	struct LibraryEntry *pParentLib;
 };
 
-/** Structure to hold a single function entry */
+/** Structure to hold a single function entry, the strings live in the manager's pool */
 struct FunctionType
 {
-	char name[FUNCTION_NAME_MAX];
-	char args[FUNCTION_ARGS_MAX];
-	char ret[FUNCTION_RET_MAX];
+	const char *name;
+	const char *args;
+	const char *ret;
 };
 
 /** Structure to hold a single library entry */
@@ -54,6 +52,8 @@ struct LibraryEntry
 	char prx[MAXPATH];
 	/** The flags as defined in the export */
 	int  flags;
+	/** Set for libraries only exported to kernel mode */
+	bool kernel;
 	/** The number of entries in the NID list */
 	int  entry_count;
 	/** The number of variable NIDs in the list */
@@ -67,19 +67,38 @@ struct LibraryEntry
 /** Class to load and manage a list of libraries */
 class CNidMgr
 {
-	typedef std::vector<FunctionType *> FunctionVect;
-
 	/** Head pointer to the list of libraries */
 	LibraryEntry *m_pLibHead;
-	/** Mapping of function names to prototypes */
-	FunctionVect  m_funcMap;
+	/** Function prototypes in the order they were loaded */
+	std::vector<FunctionType> m_funcs;
+	/** Open addressed table of indexes into m_funcs by name, -1 is empty */
+	std::vector<s32> m_funcTable;
+	/** Storage for the prototype strings */
+	CStringPool m_strings;
 	/** A buffer to store a pre-generated symbol name so it can be passed to the caller */
 	char m_szCurrName[LIB_SYMBOL_NAME_MAX];
 	/** Indicator that we have loaded a master NID file */
 	LibraryEntry *m_pMasterNids;
+	/** Running hash of every database file loaded, used to version caches */
+	u64 m_dbHash;
+	/** Names harvested from other modules, consulted before generating a name */
+	CNidMgr *m_pOverlay;
+	/** Every loaded NID sorted by name, for exact and prefix name lookups */
+	std::vector<const LibraryNid *> m_byName;
+	/** Every loaded NID sorted by value */
+	std::vector<const LibraryNid *> m_byNid;
+	/** Open addressed table of the first m_byName index for each name, -1 is empty */
+	std::vector<s32> m_nameTable;
+	/** Set when libraries were added after the name and NID indexes were built */
+	bool m_blIndexDirty;
+	void BuildIndex();
+	void AddFunction(const char *name, const char *args, const char *ret);
+	bool LoadFunctionBin(FILE *fp, const char *szFilename);
 	/** Generate a name */
 	const char *GenName(const char *lib, u32 nid);
-	/** Search the loaded libs for a symbol */
+	/** Search the loaded libs for a symbol, NULL if not found */
+	const char *FindNid(const char *lib, u32 nid);
+	/** Search the loaded libs for a symbol, generating a name if needed */
 	const char *SearchLibs(const char *lib, u32 nid);
 	void FreeMemory();
 	const char* ReadNid(TiXmlElement *pElement, u32 &nid);
@@ -95,8 +114,23 @@ public:
 	bool AddJsonFile(const char *szFilename);
 	int vita_imports_loads(FILE *text, int verbose);
 	LibraryEntry *GetLibraries(void);
+	/** Add a text or precompiled binary prototype file */
 	bool AddFunctionFile(const char *szFilename);
-	FunctionType *FindFunctionType(const char *name);
+	/** Write the loaded prototypes in the precompiled binary form */
+	bool WriteFunctionFile(FILE *fp);
+	const FunctionType *FindFunctionType(const char *name);
+	/** Add a library built in memory rather than read from a file */
+	bool AddLibrary(const char *lib_name, const char *prx_name, const LibraryNid *pNids, int iFuncs, int iVars);
+	/** Set a manager whose names take priority over generated ones */
+	void SetOverlay(CNidMgr *pOverlay);
+	/** Get a hash identifying the loaded database contents */
+	u64 GetDbHash();
+	/** Find every library entry with a name, returns the number of matches */
+	int FindByName(const char *name, std::vector<const LibraryNid *> &matches);
+	/** Find every library entry whose name starts with prefix, sorted by name */
+	int FindByPrefix(const char *prefix, std::vector<const LibraryNid *> &matches);
+	/** Find every library entry with a NID regardless of library */
+	int FindByNid(u32 nid, std::vector<const LibraryNid *> &matches);
 };
 
 #endif
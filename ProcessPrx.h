@@ -13,10 +13,19 @@
 #include "prxtypes.h"
 #include "NidMgr.h"
 #include "disasm.h"
+#include "Cfg.h"
+#include "Exidx.h"
+#include "ModeMap.h"
+#include "IntervalSet.h"
+#include "HtmlPages.h"
+#include <vector>
 
 /* Define ProcessPrx derived from ProcessElf */
 class CProcessPrx : public CProcessElf
 {
+	/* The benchmarks drive individual phases directly */
+	friend class CPrxBench;
+
 	PspModule m_modInfo;
 	CNidMgr   m_defNidMgr;
 	CNidMgr*  m_pCurrNidMgr;
@@ -27,10 +36,37 @@ class CProcessPrx : public CProcessElf
 	/* Number of relocations */
 	int m_iRelocCount;
 	ImmMap m_imms;
+	/* Error codes the code loads into registers, the target is the code */
+	ImmMap m_errs;
 	SymbolMap m_syms;
+	/* Function starts from the exception index table, empty if there is none */
+	CExidxTable m_exidx;
+	/* Instruction set of the code reached from the entry points */
+	CModeMap m_modes;
+	/* Literal pools and other data in the code, never disassembled */
+	CIntervalSet m_data;
+	/* Code pointers found in the data sections, bit 0 set for thumb */
+	std::vector<u32> m_ptrs;
+	/* Basic blocks of the functions, built before disassembling */
+	CCfg m_cfg;
+	/* Pages of the paged HTML output, see HtmlBegin */
+	CHtmlPages m_pages;
+	/* Page being written, -1 when all the output goes to one file */
+	int m_iPage;
 	u32 m_dwBase;
 	u32 m_stubBottom;
 	bool m_blXmlDump;
+	/* Stop after imports and exports, for tools that only need the linkage */
+	bool m_blSkipMaps;
+	/* Symbols and maps made for a targeted dump, see BuildRangeMaps */
+	bool m_blRangeSyms;
+	bool m_blRangeMaps;
+	/* Directory holding the analysis cache, NULL if caching is disabled */
+	const char *m_szCacheDir;
+	/* Key of this module in the analysis cache */
+	u64 m_cacheKey;
+	/* Contents of a valid cache entry for this module, empty on a miss */
+	std::vector<u32> m_cache;
 
 	bool FillModule(u8 *pData, u32 iAddr);
 	bool CreateFakeSections();
@@ -43,20 +79,37 @@ class CProcessPrx : public CProcessElf
 	int  LoadRelocsTypeA(struct ElfReloc *pRelocs);
 	int  LoadRelocsTypeB(struct ElfReloc *pRelocs);
 	bool LoadRelocs();
+	bool LoadExidx();
+	void AddExidxSymbols();
+	void ScanDataPointers();
+	void BuildDataMap();
+	void BuildModeMap(u32 dwStart, u32 dwEnd);
+	void AddImmSymbols();
+	void AddModeBranches();
+	void ScanCode(u32 dwAddr, u32 iSize, const std::vector<u32> &relocs);
 	bool BuildMaps();
+	void LoadRangeSymbols();
+	void BuildRangeMaps(u32 dwStart, u32 dwEnd);
 	void BuildSymbols();
 	void FreeSymbols();
+	u32  CountSymbols();
 	void FreeImms();
 	void FixupRelocs();
 	bool ReadString(u32 dwAddr, std::string &str, bool unicode, u32 *dwRet);
 	void DumpStrings(FILE *fp, u32 dwAddr, u32 iSize, unsigned char *pData);
 	void PrintRow(FILE *fp, const u32* row, s32 row_size, u32 addr);
 	void DumpData(FILE *fp, u32 dwAddr, u32 iSize, unsigned char *pData);
+	void DumpSections(FILE *fp, u32 dwStart, u32 dwEnd);
+	const char *HtmlPageOf(u32 dwAddr);
 	void Disasm(FILE *fp, u32 dwAddr, u32 iSize, unsigned char *pData, ImmMap &imms);
-	void DisasmXML(FILE *fp, u32 dwAddr, u32 iSize, unsigned char *pData, ImmMap &imms);
+	void DisasmXML(CXmlWriter &xml, u32 dwAddr, u32 iSize, unsigned char *pData, ImmMap &imms);
 	void CalcElfSize(size_t &iTotal, size_t &iSectCount, size_t &iStrSize);
 	bool OutputElfHeader(FILE *fp, size_t iSectCount);
 	bool OutputSections(FILE *fp, size_t iElfHeadSize, size_t iSectCount, size_t iStrSize);
+	void CacheOpen(const u8 *pData, u32 iSize, bool blBin, u32 dwDataBase);
+	bool CacheLoadRelocs();
+	bool CacheLoadMaps();
+	void CacheSave();
 
 public:
 	CProcessPrx(u32 dwBase);
@@ -67,15 +120,49 @@ public:
 	bool PrxToElf(FILE *fp);
 
 	void SetXmlDump();
+	void SetSkipMaps(bool blSkip);
+	void SetCacheDir(const char *szDir);
 	PspModule* GetModuleInfo();
 	ElfReloc* GetRelocs(int &iCount);
 	ElfSymbol* GetSymbols(int &iCount);
 	PspLibImport *GetImports();
 	PspLibExport *GetExports();
 	void SetNidMgr(CNidMgr* nidMgr);
+	int HarvestExportNames(CNidMgr &overlay);
 	void Dump(FILE *fp, const char *disopts);
+	/** Dump only the code and data between dwStart and dwEnd, analysing just that
+	 *  code. The module must be loaded with SetSkipMaps.
+	 */
+	void DumpRange(FILE *fp, const char *disopts, u32 dwStart, u32 dwEnd);
+	/** Find a function by name, alias, sub_ name or address for DumpRange */
+	bool FindFunction(const char *szName, u32 &dwStart, u32 &dwEnd);
+	/** End of the function at an address, from its size, the next function or its section */
+	u32 FindFunctionEnd(u32 dwAddr);
 	void DumpXML(FILE *fp, const char *disopts);
+	/** Start paged HTML output into szDir, writing the index and search page.
+	 *  Returns the number of pages to write with HtmlWritePage, -1 on error.
+	 */
+	int HtmlBegin(const char *szDir, const char *disopts, u32 iPageSize);
+	/** Write one page, each page can be written by a different process */
+	bool HtmlWritePage(const char *szDir, int iPage);
+	void HtmlEnd();
 	SymbolEntry *GetSymbolEntryFromAddr(u32 dwAddr);
+	const SymbolMap &GetSymbolMap();
+	/** Get the loaded image at an address and the number of bytes which follow it */
+	u8 *GetMemory(u32 dwAddr, u32 &iSize);
+	/** Get the immediates found to point into the image */
+	const ImmMap &GetImmMap();
+	/** Get the sorted addresses of the words patched by relocations */
+	void GetRelocTargets(std::vector<u32> &addrs);
+	u32 GetBase();
+	/** Instruction set of the code at an address, MODE_UNKNOWN if it is not known to be code */
+	InsnMode GetInsnMode(u32 dwAddr);
+	/** Length of the instruction starting at an address, 0 if none is known to */
+	u32 GetInsnSize(u32 dwAddr);
+	/** Data found in the executable sections, sorted and merged */
+	const CIntervalSet &GetDataMap();
+	/** Build the basic blocks of every function, call after loading */
+	const CCfg &BuildCfg();
 };
 
 #endif
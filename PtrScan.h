@@ -0,0 +1,38 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * PtrScan.h - Definition of a class to find pointers to code in
+ * data sections.
+ ***************************************************************/
+#ifndef __PTRSCAN_H__
+#define __PTRSCAN_H__
+
+#include <vector>
+#include "types.h"
+
+/* Code below this looks like small integers, data without relocations isn't scanned for it */
+#define PTRSCAN_MIN_TEXT 0x10000
+
+/** Class to find the aligned words in data which point into the code,
+ *  function pointer tables, vtables and the like, in one pass.
+ */
+class CPtrScanner
+{
+	/** Address range of the code, end exclusive */
+	u32 m_dwTextStart;
+	u32 m_dwTextEnd;
+
+	bool IsCode(u32 dwValue) const;
+public:
+	CPtrScanner();
+	~CPtrScanner();
+	void SetText(u32 dwStart, u32 dwEnd);
+	/** Append the address of each word in pData at dwAddr which points into
+	 *  the code to hits. If pRelocs is set it holds the sorted addresses of
+	 *  the relocated words and only those are taken as pointers.
+	 */
+	void Scan(const u8 *pData, u32 dwAddr, u32 iSize, const std::vector<u32> *pRelocs, std::vector<u32> &hits) const;
+};
+
+#endif
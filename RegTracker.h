@@ -0,0 +1,41 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * RegTracker.h - Definition of a class to follow constants through
+ * the core registers.
+ ***************************************************************/
+#ifndef __REGTRACKER_H__
+#define __REGTRACKER_H__
+
+#include "types.h"
+#include "disasm.h"
+
+/* r0 to r3, r12 and lr, which a call doesn't preserve */
+#define REG_CALLER_SAVED 0x500F
+
+/** Class to follow the constants held in the core registers through
+ *  straight line code, to find the addresses a function builds with
+ *  movw and movt, add rX, pc or a load from a literal pool.
+ */
+class CRegTracker
+{
+	u32 m_values[16];
+	/** Bit per register holding a known value */
+	u32 m_known;
+	/** Instructions left in the current IT block */
+	u32 m_iIt;
+public:
+	CRegTracker();
+	~CRegTracker();
+	/** Forget every register, at the start of a function or a block */
+	void Reset();
+	/** Apply an instruction decoded by disasmRegOp, for REG_OP_LITERAL
+	 *  op.value must already be replaced by the word loaded. Returns
+	 *  REG_OP_MOVT, REG_OP_ADDPC or REG_OP_LITERAL and the value when the
+	 *  instruction completes a constant, otherwise REG_OP_NONE.
+	 */
+	int Step(const RegOp &op, int flow, u32 &dwValue);
+};
+
+#endif
@@ -0,0 +1,94 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * SigScan.h - Definition of a class to search module images for
+ * byte patterns with wildcards.
+ ***************************************************************/
+#ifndef __SIGSCAN_H__
+#define __SIGSCAN_H__
+
+#include <string>
+#include <vector>
+#include "types.h"
+
+/** A byte pattern, bits clear in the mask match anything */
+struct SigPattern
+{
+	std::string name;
+	std::vector<u8> bytes;
+	std::vector<u8> masks;
+	/** Longest run of fully known bytes, found with the automaton */
+	u32 iAnchor;
+	u32 iAnchorLen;
+};
+
+/** A pattern found in a buffer */
+struct SigMatch
+{
+	int sig;
+	/** Offset of the start of the pattern in the buffer */
+	u32 offset;
+};
+
+/** A buffer to scan, such as one section of a module */
+struct SigBuffer
+{
+	const u8 *pData;
+	u32 iSize;
+};
+
+/** A pattern found in one of a list of buffers */
+struct SigHit
+{
+	int buffer;
+	int sig;
+	u32 offset;
+};
+
+/** Class to find many byte patterns in one pass using an Aho-Corasick
+ *  automaton over the anchor of each pattern. With few distinct first
+ *  bytes the automaton runs over the whole buffer skipping ahead with
+ *  SIMD compares, otherwise a byte pair filter picks where to walk it.
+ */
+class CSigScanner
+{
+	std::vector<SigPattern> m_sigs;
+	/** Full transition table, 256 entries per state */
+	std::vector<s32> m_delta;
+	/** Patterns whose anchor ends in each state */
+	std::vector<std::vector<int> > m_outputs;
+	/** Depth of each state in the anchor trie */
+	std::vector<u32> m_depth;
+	/** Bytes leaving the root state, used to skip ahead while nothing is partly matched */
+	std::vector<u8> m_first;
+	/** One bit for each pair of bytes which starts an anchor */
+	std::vector<u32> m_pairs;
+	u32 m_iMaxLen;
+	bool m_blCompiled;
+
+	bool Verify(const SigPattern &sig, const u8 *pData) const;
+	u32 SkipToFirst(const u8 *pData, u32 iPos, u32 iEnd) const;
+	void Report(s32 state, u32 iPos, u32 iAnchorLen, const u8 *pData, u32 iSize, u32 iStart, u32 iEnd,
+			std::vector<SigMatch> &matches) const;
+	static void Work(void *pArg, int iThread);
+public:
+	CSigScanner();
+	~CSigScanner();
+	/** Add an IDA style pattern such as "2D E9 ?? 4? 00", or "\x2D\xE9\x00 xx?" with a mask */
+	bool AddPattern(const char *name, const char *pattern);
+	/** Load a file of name and pattern lines, # starts a comment */
+	bool LoadFile(const char *szFilename);
+	/** Build the automaton, done on the first scan if not called */
+	void Compile();
+	int GetCount() const;
+	const SigPattern &GetPattern(int iSig) const;
+	/** Length of the longest pattern in bytes */
+	u32 GetMaxLen() const;
+	/** Find every pattern starting in [iStart, iEnd) of a buffer of iSize bytes */
+	void Scan(const u8 *pData, u32 iSize, u32 iStart, u32 iEnd, std::vector<SigMatch> &matches);
+	/** Scan a list of buffers split into chunks over iThreads threads, hits are sorted by buffer and offset */
+	void ScanBuffers(const std::vector<SigBuffer> &buffers, int iThreads, std::vector<SigHit> &hits);
+};
+
+#endif
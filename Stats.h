@@ -0,0 +1,91 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * Stats.h - Definition of a static class to collect per phase
+ * timing and memory statistics.
+ ***************************************************************/
+
+#ifndef __STATS_H__
+#define __STATS_H__
+
+#include <stdio.h>
+#include "types.h"
+
+enum StatPhase
+{
+	STAT_PHASE_READ = 0,
+	STAT_PHASE_IMAGE,
+	STAT_PHASE_RELOCS,
+	STAT_PHASE_FIXUP,
+	STAT_PHASE_IMPEXP,
+	STAT_PHASE_SYMBOLS,
+	STAT_PHASE_MAPS,
+	STAT_PHASE_DUMP,
+	STAT_PHASE_SERIALIZE,
+	STAT_PHASE_COUNT
+};
+
+enum StatCounter
+{
+	/* Instructions decoded, once per call into the disassembler, so it
+	 * counts the analysis passes as well as the text or XML output */
+	STAT_INSNS = 0,
+	STAT_SYMBOLS,
+	STAT_NID_HITS,
+	STAT_NID_MISSES,
+	STAT_BYTES_WRITTEN,
+	STAT_COUNTER_COUNT
+};
+
+enum StatFormat
+{
+	STAT_FORMAT_TABLE = 0,
+	STAT_FORMAT_JSON = 1
+};
+
+struct StatRecord;
+class CStatTimer;
+
+class CStats
+{
+	friend class CStatTimer;
+
+	/* Indicates stats are being collected */
+	static bool m_blEnabled;
+	static StatFormat m_format;
+	static StatRecord *m_pCurrent;
+	static CStatTimer *m_pTimer;
+	CStats() {};
+	~CStats() {};
+public:
+	static void Enable(StatFormat format);
+	static bool GetEnabled();
+	static void BeginFile(const char *szFilename);
+	static void Add(StatCounter counter, u64 val);
+	static FILE *WrapOutput(FILE *fp);
+	static void Print(const char *szFilename);
+};
+
+/* Scoped timer for a single phase, nested timers pause their parent so phase times are exclusive */
+class CStatTimer
+{
+	StatPhase m_phase;
+	CStatTimer *m_pParent;
+	bool m_blActive;
+	double m_wall;
+	double m_cpu;
+	u64 m_allocs;
+	u64 m_allocBytes;
+
+	void Start();
+	void Stop();
+public:
+	CStatTimer(StatPhase phase);
+	~CStatTimer();
+};
+
+/* Quick inline check so the counters cost nothing when stats are off */
+#define STAT_ADD(counter, val) do { if(CStats::GetEnabled()) { CStats::Add((counter), (val)); } } while(0)
+
+#endif
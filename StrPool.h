@@ -0,0 +1,39 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * StrPool.h - Definition of a class to store strings compactly,
+ * keeping one copy of each.
+ ***************************************************************/
+#ifndef __STRPOOL_H__
+#define __STRPOOL_H__
+
+#include <stddef.h>
+#include <vector>
+#include "types.h"
+
+/** Class to intern strings, returned pointers live as long as the pool */
+class CStringPool
+{
+	/** Blocks the strings are packed into */
+	std::vector<char *> m_blocks;
+	/** Bytes left in the last block */
+	size_t m_iFree;
+	char *m_pNext;
+	/** Open addressed table of interned strings, NULL is empty */
+	std::vector<const char *> m_table;
+	size_t m_iCount;
+
+	char *Alloc(size_t iSize);
+	void Grow();
+public:
+	CStringPool();
+	~CStringPool();
+	/** Get the pooled copy of a string, adding it if needed */
+	const char *Intern(const char *str);
+	/** Take a copy of a block of NUL terminated strings without interning them */
+	const char *AddBlock(const char *pData, size_t iSize);
+	void Clear();
+};
+
+#endif
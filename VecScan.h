@@ -0,0 +1,37 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * VecScan.h - Vector helpers shared by the scanners which walk
+ * memory a word at a time.
+ ***************************************************************/
+#ifndef __VECSCAN_H__
+#define __VECSCAN_H__
+
+#include "types.h"
+
+/* SCAN_SIMD is defined when the words can be compared SCAN_LANES at a time */
+#if (defined(__AVX2__) || defined(__SSE2__)) && !defined(WORDS_BIGENDIAN)
+#include <immintrin.h>
+#define SCAN_SIMD
+
+#if defined(__AVX2__)
+#define SCAN_LANES 8
+typedef __m256i vec;
+#define V_SET1(x)   _mm256_set1_epi32((int) (x))
+#define V_LOAD(p)   _mm256_loadu_si256((const __m256i *) (p))
+#else
+#define SCAN_LANES 4
+typedef __m128i vec;
+#define V_SET1(x)   _mm_set1_epi32((int) (x))
+#define V_LOAD(p)   _mm_loadu_si128((const __m128i *) (p))
+#endif
+#endif
+
+/* Little endian word at any alignment */
+static inline u32 scan_word(const u8 *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((u32) p[3] << 24);
+}
+
+#endif
@@ -0,0 +1,52 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * WordScan.h - Definition of a class to search memory for runs
+ * of 32 bit words.
+ ***************************************************************/
+#ifndef __WORDSCAN_H__
+#define __WORDSCAN_H__
+
+#include <vector>
+#include "types.h"
+
+#define WORDSIG_MAX 8
+
+/** A run of little endian words to find, compared under a mask */
+struct WordSig
+{
+	const char *name;
+	/** Number of words in the signature */
+	int iWords;
+	u32 words[WORDSIG_MAX];
+	u32 masks[WORDSIG_MAX];
+	/** Bit n set means word n must not match rather than match */
+	u32 iInvert;
+	/** Offset of the structure being looked for from the start of the match */
+	u32 iOffset;
+};
+
+/** Class to find word aligned signatures in one pass over memory */
+class CWordScanner
+{
+	std::vector<WordSig> m_sigs;
+	/** Index of the word in each signature the scan compares first */
+	std::vector<int> m_anchors;
+
+	bool Verify(int iSig, const u8 *pData) const;
+	void CheckWord(const u8 *pData, u32 iWord, u32 iWords, int &iBest, u32 &iOffset) const;
+public:
+	CWordScanner();
+	~CWordScanner();
+	/** Add a signature, earlier signatures take priority over later ones */
+	bool AddSignature(const WordSig &sig);
+	const WordSig &GetSignature(int iSig) const;
+	/** Find the first match of the highest priority signature present.
+	 *  iOffset is the byte offset of the match in pData, not including the
+	 *  signature's own iOffset. Returns the signature index or -1.
+	 */
+	int ScanBest(const u8 *pData, u32 iSize, u32 &iOffset) const;
+};
+
+#endif
@@ -0,0 +1,56 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * XmlWriter.h - Definition of a class to stream XML to a file
+ ***************************************************************/
+#ifndef __XMLWRITER_H__
+#define __XMLWRITER_H__
+
+#include <stdio.h>
+#include "types.h"
+
+/* Deepest nesting of elements the writer tracks */
+#define XMLWRITER_MAX_DEPTH 16
+
+/** Class to write XML straight to a file as it is produced, escaping
+ *  text and attributes. Only the names of the open elements are kept, so
+ *  the memory used doesn't grow with the document.
+ */
+class CXmlWriter
+{
+	FILE *m_fp;
+	/** Open elements, the names must outlive the element */
+	const char *m_tags[XMLWRITER_MAX_DEPTH];
+	/** Elements whose children go on their own lines */
+	bool m_blocks[XMLWRITER_MAX_DEPTH];
+	int m_iDepth;
+	/** Elements opened past XMLWRITER_MAX_DEPTH, skipped along with their content */
+	int m_iDropped;
+	/** The start tag of the innermost element is still open for attributes */
+	bool m_blInTag;
+	/** The innermost element has content */
+	bool m_blContent;
+
+	void Escape(const char *str, bool blAttr);
+	void CloseTag();
+public:
+	CXmlWriter(FILE *fp);
+	~CXmlWriter();
+	/** Open an element, a block element puts each child on its own line */
+	void Start(const char *szTag, bool blBlock = false);
+	void Attr(const char *szName, const char *szValue);
+	void AttrHex(const char *szName, u32 dwValue);
+	/** Attribute of comma separated hex values */
+	void AttrHexList(const char *szName, const u32 *pValues, size_t iCount);
+	void Text(const char *szText);
+	/** Close the innermost element, as an empty tag if nothing was written in it */
+	void End();
+	/** Write an element holding only text */
+	void Element(const char *szTag, const char *szText);
+	void ElementHex(const char *szTag, u32 dwValue);
+	/** Close every open element */
+	void Finish();
+};
+
+#endif
@@ -0,0 +1,125 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * XrefIndex.h - Definition of a class to index the calls and data
+ * references between the functions of a module.
+ ***************************************************************/
+
+#ifndef __XREFINDEX_H__
+#define __XREFINDEX_H__
+
+#include <stdio.h>
+#include <utility>
+#include <vector>
+#include "types.h"
+#include "StrPool.h"
+
+class CProcessPrx;
+
+enum XrefNodeType
+{
+	XREF_NODE_FUNC = 0,
+	XREF_NODE_IMPORT = 1,
+	XREF_NODE_DATA = 2
+};
+
+enum XrefEdgeType
+{
+	/** Branch to a function */
+	XREF_CALL = 0,
+	/** Branch to an import stub */
+	XREF_IMPORT = 1,
+	/** Immediate pointing at data */
+	XREF_DATA = 2,
+	/** Immediate pointing at code, the address of a function is taken */
+	XREF_ADDR = 3
+};
+
+struct XrefNode
+{
+	u32 addr;
+	XrefNodeType type;
+	/** Pooled name */
+	const char *name;
+};
+
+struct XrefEdge
+{
+	u32 from;
+	u32 to;
+	/** Address of the referencing instruction */
+	u32 site;
+	XrefEdgeType type;
+};
+
+/** A node found by a reachability query */
+struct XrefHit
+{
+	u32 node;
+	/** Number of edges from the start node */
+	u32 depth;
+	/** Index of the edge it was first reached by in the direction searched, -1 for the start */
+	s32 edge;
+};
+
+enum XrefFormat
+{
+	XREF_TEXT = 0,
+	XREF_DOT = 1,
+	XREF_JSON = 2
+};
+
+/** Class to hold the call graph and cross references of one module as
+ *  compressed sparse rows, nodes sorted by address and the edges of each
+ *  node sorted by the address of the reference, in both directions.
+ */
+class CXrefIndex
+{
+	CStringPool m_names;
+	std::vector<XrefNode> m_nodes;
+	/** Node indexes of the functions and import stubs, by address */
+	std::vector<u32> m_funcs;
+	/** Edges sorted by source, m_outStart[n] to m_outStart[n + 1] leave node n */
+	std::vector<u32> m_outStart;
+	std::vector<XrefEdge> m_out;
+	/** Edges sorted by target, m_inStart[n] to m_inStart[n + 1] arrive at node n */
+	std::vector<u32> m_inStart;
+	std::vector<XrefEdge> m_in;
+	/** Names and aliases of the nodes */
+	std::vector<std::pair<const char *, u32> > m_keys;
+	/** Open addressed table of indexes into m_keys, -1 is empty */
+	std::vector<s32> m_table;
+	/** Generation stamps for the reachability search */
+	std::vector<u32> m_visited;
+	u32 m_iStamp;
+
+	void BuildTable();
+	s32 FindFunc(u32 dwAddr) const;
+	s32 ResolveTarget(u32 dwAddr, bool blText) const;
+	void WriteText(FILE *fp, const std::vector<XrefHit> &hits, bool blCallers) const;
+	void WriteDot(FILE *fp, const std::vector<XrefHit> &hits, bool blCallers) const;
+	void WriteJson(FILE *fp, const std::vector<XrefHit> &hits, bool blCallers) const;
+public:
+	CXrefIndex();
+	~CXrefIndex();
+	/** Build the index from the symbols and immediates of a loaded module */
+	void Build(CProcessPrx &prx);
+	u32 GetNodeCount() const;
+	u32 GetEdgeCount() const;
+	const XrefNode &GetNode(u32 iNode) const;
+	/** Find a node by name or alias, -1 if not found */
+	s32 FindNode(const char *name) const;
+	/** Find the node at an address, or the function holding it, -1 if there is none */
+	s32 FindAddr(u32 dwAddr) const;
+	/** Edges leaving a node, returns the count */
+	u32 GetCallees(u32 iNode, const XrefEdge *&pEdges) const;
+	/** Edges arriving at a node, returns the count */
+	u32 GetCallers(u32 iNode, const XrefEdge *&pEdges) const;
+	/** Breadth first search from a node along callers or callees, iDepth 0 is unlimited */
+	void Reach(u32 iNode, u32 iDepth, bool blCallers, std::vector<XrefHit> &hits);
+	/** Write the result of Reach, or the whole index if hits is empty */
+	void Write(FILE *fp, XrefFormat format, const std::vector<XrefHit> &hits, bool blCallers) const;
+};
+
+#endif
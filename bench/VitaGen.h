@@ -0,0 +1,56 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * VitaGen.h - Generator for synthetic Vita style modules used
+ * by the benchmarks.
+ ***************************************************************/
+#ifndef __VITAGEN_H__
+#define __VITAGEN_H__
+
+#include <string>
+#include <vector>
+#include "types.h"
+
+/** Parameters controlling the shape of a generated module */
+struct VitaGenParams
+{
+	/** Approximate size of the code in bytes */
+	u32 iTextSize;
+	/** Average function size in instructions */
+	u32 iFuncWords;
+	/** Number of imported libraries */
+	u32 iImportLibs;
+	/** Number of functions imported from each library */
+	u32 iImportFuncs;
+	/** Number of exported functions */
+	u32 iExportFuncs;
+	/** Number of strings in the read only data */
+	u32 iStrings;
+	/** Size of the initialised data segment in bytes */
+	u32 iDataSize;
+	/** Seed for the pseudo random generator */
+	u32 iSeed;
+};
+
+/** Information about a generated module, for use by the benchmarks */
+struct VitaGenInfo
+{
+	/** Size of the ELF file in bytes */
+	u32 iFileSize;
+	/** Number of instructions in the code */
+	u32 iInsns;
+	/** Number of relocations */
+	u32 iRelocs;
+	/** Library name for every imported NID */
+	std::vector<std::string> libs;
+	/** Imported NIDs, parallel to libs */
+	std::vector<u32> nids;
+};
+
+/* Fill in the default parameters */
+void vitagenDefaults(VitaGenParams &params);
+/* Write a module to szElf, and a matching NID database to szDb if not NULL */
+bool vitagenWrite(const VitaGenParams &params, const char *szElf, const char *szDb, VitaGenInfo *pInfo);
+
+#endif
@@ -12,6 +12,8 @@
 #include <vector>
 #include "prxtypes.h"
 
+class CXmlWriter;
+
 enum SymbolType
 {
 	SYMBOL_NOSYM = 0,
@@ -46,7 +48,26 @@ struct ImmEntry
 	int text;
 };
 
-typedef std::map<unsigned int, ImmEntry *> ImmMap;
+/* Sorted by addr, see disasmSortImms */
+typedef std::vector<ImmEntry> ImmMap;
+
+/* Register written by an instruction, from disasmRegOp */
+#define REG_OP_NONE    0 /* No register the tracker follows is written */
+#define REG_OP_CLOBBER 1 /* The registers in mask get unknown values */
+#define REG_OP_MOV     2 /* reg is set to value, mov or movw */
+#define REG_OP_MOVT    3 /* The top half of reg is set to value */
+#define REG_OP_ADDPC   4 /* add reg, pc, value is what pc reads as */
+#define REG_OP_LITERAL 5 /* reg is loaded from the word at value */
+
+struct RegOp
+{
+	int op;
+	/* Core register 0 to 15 */
+	int reg;
+	unsigned int value;
+	/* Bit per core register written, including reg */
+	unsigned int mask;
+};
 
 #define DISASM_OPT_MAX       8
 #define DISASM_OPT_HEXINTS   'x'
@@ -61,7 +82,23 @@ typedef std::map<unsigned int, ImmEntry *> ImmMap;
 #define INSTR_TYPE_LOCAL 1
 #define INSTR_TYPE_FUNC  2
 
+/* Control flow of an instruction, from disasmControlFlow */
+#define INSTR_FLOW_BRANCH   0x01 /* Direct branch or call, the target is set */
+#define INSTR_FLOW_CALL     0x02 /* Call, comes back to the next instruction */
+#define INSTR_FLOW_COND     0x04 /* Conditional, can fall through */
+#define INSTR_FLOW_RETURN   0x08 /* Return to the caller */
+#define INSTR_FLOW_INDIRECT 0x10 /* Jump to a computed address */
+#define INSTR_FLOW_IT       0x20 /* Thumb IT, makes the next INSTR_FLOW_ITCOUNT instructions conditional */
+#define INSTR_FLOW_EXCHANGE 0x40 /* BLX to an immediate, the target is in the other instruction set */
+#define INSTR_FLOW_INVALID  0x80 /* Could not be decoded */
+#define INSTR_FLOW_LITERAL  0x800 /* PC relative load, the target is the address of the data */
+#define INSTR_FLOW_ITCOUNT(f) (((f) >> 8) & 7)
+#define INSTR_FLOW_LITSIZE(f) (((f) >> 12) & 15) /* Bytes loaded by an INSTR_FLOW_LITERAL */
+
 void SetThumbMode(bool mode);
+bool GetThumbMode();
+/* Switch the instruction set decoded, returns whether it was thumb before */
+bool disasmSetThumb(bool thumb);
 
 /* Enable hexadecimal integers for immediates */
 void disasmSetHexInts(int hexints);
@@ -76,15 +113,26 @@ void disasmSetOpts(const char *opts, int set);
 const char *disasmGetOpts(void);
 void disasmPrintOpts(void);
 const char *disasmInstruction(unsigned int opcode, unsigned int *PC, unsigned int *realregs, unsigned int *regmask, int nothumb);
-const char *disasmInstructionXML(unsigned int opcode, unsigned int PC);
+/* Write the elements of an <inst> for the instruction at PC, advances PC past it */
+void disasmInstructionXML(unsigned int opcode, unsigned int *PC, CXmlWriter &xml);
+/* Format data in a code section, iSize is 2 or 4 bytes and PC is advanced past it */
+const char *disasmData(unsigned int data, unsigned int *PC, int iSize);
 
 void disasmSetSymbols(SymbolMap *syms);
 void disasmAddBranchSymbols(unsigned int opcode, unsigned int *PC, SymbolMap &syms);
+/* Add the symbol for a branch of INSTR_TYPE_LOCAL or INSTR_TYPE_FUNC to addr from PC */
+void disasmAddBranchSymbol(unsigned int addr, unsigned int PC, int insttype, SymbolMap &syms);
 SymbolType disasmResolveSymbol(unsigned int PC, char *name, int namelen);
 SymbolEntry* disasmFindSymbol(unsigned int PC);
 int disasmIsBranch(unsigned int opcode, unsigned int PC, unsigned int *dwTarget);
+/* Classify the control flow of an instruction, advances PC past it */
+int disasmControlFlow(unsigned int opcode, unsigned int *PC, unsigned int *dwTarget);
 void disasmSetXmlOutput();
-int disasmAddStringRef(unsigned int opcode, unsigned int base, unsigned int size, unsigned int PC, ImmMap &imms);
-void resetMovwMovt();
+/* Find the register an instruction writes for CRegTracker, returns the flow and target like disasmControlFlow */
+int disasmRegOp(unsigned int opcode, unsigned int *PC, RegOp *op, unsigned int *dwTarget);
+/* Sort immediates by address, keeping the first added for each address */
+void disasmSortImms(ImmMap &imms);
+/* Find the immediate used by the instruction at addr, the map must be sorted */
+const ImmEntry *disasmFindImm(const ImmMap &imms, unsigned int addr);
 
 #endif
@@ -22,6 +22,8 @@ enum ArgOpts
 {
 	ARG_OPT_NONE,
 	ARG_OPT_REQUIRED,
+	/* Argument can only be passed as --full=value */
+	ARG_OPT_OPTIONAL,
 };
 
 struct ArgEntry
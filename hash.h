@@ -0,0 +1,25 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * hash.h - Simple content hashing helpers
+ ***************************************************************/
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include <stddef.h>
+#include "types.h"
+
+/* Initial value for a hash chain */
+#define HASH_SEED 0xCBF29CE484222325ULL
+
+/* Hash a block of memory, chaining from seed */
+u64 hashData(const void *pData, size_t iSize, u64 seed);
+/* Hash a NUL terminated string, chaining from seed */
+u64 hashString(const char *str, u64 seed);
+/* Hash a single 32bit value, chaining from seed */
+u64 hashU32(u32 val, u64 seed);
+/* Hash the contents of a file, returns false if the file could not be read */
+bool hashFile(const char *szFilename, u64 &hash, u32 &iSize);
+
+#endif
@@ -0,0 +1,163 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * libprxtool.h - Public interface to the prxtool library, a
+ * C ABI usable from other languages and a small C++ wrapper.
+ ***************************************************************/
+
+#ifndef __LIBPRXTOOL_H__
+#define __LIBPRXTOOL_H__
+
+#include <stddef.h>
+
+/* Bumped whenever the layout of a public structure changes */
+#define PRXTOOL_API_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Load and disassembly options, replaces the old command line globals */
+typedef struct PrxToolOptions
+{
+	/* Set to sizeof(PrxToolOptions) by prxtool_options_init */
+	unsigned int size;
+	/* Base address to relocate the module to */
+	unsigned int base;
+	/* Load the file as a raw binary rather than an ELF */
+	int binary;
+	/* Start of the data segment when loading a raw binary */
+	unsigned int data_base;
+	/* Disassemble as thumb rather than ARM */
+	int thumb;
+	/* Emit HTML rather than plain text disassembly */
+	int xml;
+	/* Disassembler option string, see prxtool --help */
+	const char *disopts;
+	/* Analysis cache directory, NULL to disable caching */
+	const char *cache_dir;
+} PrxToolOptions;
+
+/* Opaque handle to a loaded module */
+typedef struct PrxToolModule PrxToolModule;
+
+/* Opaque handle to a set of NID databases, shareable between modules */
+typedef struct PrxToolNids PrxToolNids;
+
+/* A single imported or exported function or variable */
+typedef struct PrxToolEntry
+{
+	/* Library name */
+	const char *lib;
+	/* Resolved (or generated) name of the entry */
+	const char *name;
+	unsigned int nid;
+	/* Address of the stub or export */
+	unsigned int addr;
+	/* Non zero for variables, zero for functions */
+	int is_var;
+} PrxToolEntry;
+
+enum PrxToolSymbolType
+{
+	PRXTOOL_SYM_UNKNOWN = 1,
+	PRXTOOL_SYM_FUNC = 2,
+	PRXTOOL_SYM_LOCAL = 3,
+	PRXTOOL_SYM_DATA = 4
+};
+
+/* A symbol discovered while analysing the module */
+typedef struct PrxToolSymbol
+{
+	unsigned int addr;
+	unsigned int size;
+	/* One of PrxToolSymbolType */
+	int type;
+	const char *name;
+} PrxToolSymbol;
+
+/* Callback for library diagnostics, level matches OutputLevel (0 info, 1 warning, 2 error, 3 debug) */
+typedef void (*PrxToolLogFunc)(int level, const char *msg);
+
+/* Returns PRXTOOL_API_VERSION of the library actually loaded */
+int prxtool_api_version(void);
+/* Fill an options structure with the defaults */
+void prxtool_options_init(PrxToolOptions *opts);
+/* Route diagnostics to a callback, NULL discards them */
+void prxtool_set_log(PrxToolLogFunc fn);
+/* Description of the last failure on this thread */
+const char *prxtool_last_error(void);
+
+/* Create an empty NID database set and add files to it */
+PrxToolNids *prxtool_nids_new(void);
+int prxtool_nids_add_json(PrxToolNids *nids, const char *path);
+int prxtool_nids_add_functions(PrxToolNids *nids, const char *path);
+void prxtool_nids_free(PrxToolNids *nids);
+
+/* Load a module, nids may be NULL. Returns NULL on failure */
+PrxToolModule *prxtool_load(const char *path, const PrxToolOptions *opts, PrxToolNids *nids);
+void prxtool_free(PrxToolModule *mod);
+const char *prxtool_module_name(const PrxToolModule *mod);
+
+/* Imports and exports, flattened across all libraries. Getters return 0 on success */
+int prxtool_import_count(const PrxToolModule *mod);
+int prxtool_get_import(const PrxToolModule *mod, int index, PrxToolEntry *entry);
+int prxtool_export_count(const PrxToolModule *mod);
+int prxtool_get_export(const PrxToolModule *mod, int index, PrxToolEntry *entry);
+
+/* Symbols in address order */
+int prxtool_symbol_count(const PrxToolModule *mod);
+int prxtool_get_symbol(const PrxToolModule *mod, int index, PrxToolSymbol *sym);
+
+/* Disassemble the module into buf. Returns the full length of the
+ * output (excluding the terminator) like snprintf, so a call with a
+ * NULL buffer can be used to size it. Returns -1 on failure.
+ */
+long prxtool_disasm(PrxToolModule *mod, char *buf, size_t size);
+
+#ifdef __cplusplus
+}
+
+#include <string>
+#include <vector>
+
+class CProcessPrx;
+class CNidMgr;
+
+/* Fills in options from defaults, for C++ callers */
+PrxToolOptions prxtoolDefaultOptions();
+/* Load a module into prx honouring opts, the single load path shared by the tool and library */
+bool prxtoolLoad(CProcessPrx &prx, const char *szFilename, const PrxToolOptions &opts);
+
+/* C++ interface to a single module */
+class CPrxTool
+{
+	PrxToolOptions m_opts;
+	CProcessPrx *m_pPrx;
+	CNidMgr *m_pNids;
+	std::vector<PrxToolEntry> m_imports;
+	std::vector<PrxToolEntry> m_exports;
+	std::vector<PrxToolSymbol> m_syms;
+	std::string m_disasm;
+	bool m_blDisasm;
+
+	void Free();
+	void BuildTables();
+public:
+	CPrxTool(const PrxToolOptions &opts, CNidMgr *pNids = NULL);
+	~CPrxTool();
+	bool Load(const char *szFilename);
+	const char *GetName() const;
+	const std::vector<PrxToolEntry> &GetImports() const { return m_imports; }
+	const std::vector<PrxToolEntry> &GetExports() const { return m_exports; }
+	const std::vector<PrxToolSymbol> &GetSymbols() const { return m_syms; }
+	/* Disassembly text, generated on first use */
+	const std::string *Disasm();
+	/* Access to the underlying processor for anything not covered above */
+	CProcessPrx *GetPrx() { return m_pPrx; }
+};
+
+#endif
+
+#endif
@@ -19,6 +19,11 @@
 #define PSP_MAX_F_ENTRIES 4096
 
 #define PSP_MODULE_INFO_NAME ".sceModuleInfo.rodata"
+#define ARM_EXIDX_NAME ".ARM.exidx"
+
+/* Offsets of the exception index range in a Vita module info */
+#define VITA_MODULE_INFO_EXIDX_TOP 0x4C
+#define VITA_MODULE_INFO_EXIDX_END 0x50
 
 /* Define a name for the unnamed first export */
 #define PSP_SYSTEM_EXPORT "syslib"
@@ -170,6 +175,9 @@ struct PspModule
 	PspModuleInfo info;
 	/** Virtual address of the module info section */
 	u32 addr;
+	/** Range of the ARM exception index table from a Vita module info, unchecked */
+	u32 exidx_top;
+	u32 exidx_end;
 	/** Head of the export list */
 	PspLibExport *exp_head;
 	/** Head of the import list */
@@ -0,0 +1,47 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * sha1.h - SHA-1 for NID generation, plus a multi buffer version
+ * for hashing many short names at once.
+ ***************************************************************/
+#ifndef __SHA1_H__
+#define __SHA1_H__
+
+#include <stddef.h>
+#include "types.h"
+
+#if defined(__AVX2__)
+#define SHA1_LANES 8
+#else
+#define SHA1_LANES 4
+#endif
+
+/* Longest message which fits in a single padded block */
+#define SHA1_MAX_SHORT 55
+
+struct Sha1Ctx
+{
+	u32 h[5];
+	u64 iLen;
+	u8 buf[64];
+	u32 iUsed;
+};
+
+void sha1Init(Sha1Ctx *ctx);
+void sha1Update(Sha1Ctx *ctx, const void *pData, size_t iSize);
+void sha1Final(Sha1Ctx *ctx, u8 digest[20]);
+
+/* A NID is the first four bytes of the digest, little endian */
+u32 sha1Nid(const void *pData, size_t iSize);
+
+/* Add the padding and length to a block whose first iLen bytes hold a message */
+void sha1PadBlock(u8 *pBlock, u32 iLen);
+
+/* NIDs of SHA1_LANES messages, each already padded in a 64 byte block */
+void sha1NidBlocks(const u8 pBlocks[SHA1_LANES][64], u32 nids[SHA1_LANES]);
+
+/* Name of the kernel sha1NidBlocks was built with */
+const char *sha1KernelName();
+
+#endif
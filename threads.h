@@ -0,0 +1,21 @@
+/***************************************************************
+ * PRXTool : Utility for PSP executables.
+ * (c) TyRaNiD 2k6
+ *
+ * threads.h - Minimal helpers to run work across CPU threads.
+ ***************************************************************/
+#ifndef __THREADS_H__
+#define __THREADS_H__
+
+typedef void (*ThreadFunc)(void *pArg, int iThread);
+
+/* Number of threads to use, iWanted <= 0 means one per online CPU */
+int threadCount(int iWanted);
+
+/* Run fn(pArg, i) for i in [0, iThreads) on separate threads and wait
+ * for all of them. Index 0 runs on the calling thread. If a thread can
+ * not be started its index is run on the caller once the others finish.
+ */
+void threadRun(int iThreads, ThreadFunc fn, void *pArg);
+
+#endif